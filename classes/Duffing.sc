@@ -2,10 +2,18 @@ DuffingOsc : UGen {
 	*ar { |freq = 440, amp = 1.0, damping = 0.1, stiffness = 0.5, nonLinearity = 0.5|
 		^this.multiNew('audio', freq, amp, damping, stiffness, nonLinearity);
 	}
+
+	*kr { |freq = 440, amp = 1.0, damping = 0.1, stiffness = 0.5, nonLinearity = 0.5|
+		^this.multiNew('control', freq, amp, damping, stiffness, nonLinearity);
+	}
 }
 
 DuffingExt : UGen {
 	*ar { |in, damping = 0.1, stiffness = 0.5, nonLinearity = 0.5|
 		^this.multiNew('audio', in, damping, stiffness, nonLinearity);
 	}
-}
\ No newline at end of file
+
+	*kr { |in, damping = 0.1, stiffness = 0.5, nonLinearity = 0.5|
+		^this.multiNew('control', in, damping, stiffness, nonLinearity);
+	}
+}
@@ -0,0 +1,31 @@
+ODEExpr : UGen {
+	classvar <opcodes, <registers;
+
+	*initClass {
+		opcodes = (const: 0, add: 1, sub: 2, mul: 3, div: 4, neg: 5, abs: 6, sin: 7, cos: 8, tanh: 9);
+		registers = (x: 0, y: 1, yPrime: 2, in: 3, p0: 4, p1: 5, p2: 6, p3: 7);
+	}
+
+	*ar { |bufnum, in, p0 = 0.0, p1 = 0.0, p2 = 0.0, p3 = 0.0|
+		^this.multiNew('audio', bufnum, in, p0, p1, p2, p3);
+	}
+
+	// Flattens an Array of [opcode, dest, a, b] instructions, with opcodes and input registers given as Symbols, into
+	// the numeric form expected in the program Buffer.
+	*program { |instructions|
+		^instructions.collect({ |instruction|
+			var op = opcodes[instruction[0]];
+			var operands = instruction.copyRange(1, 3).collect({ |operand, i|
+				if (operand.isKindOf(Symbol), { registers[operand] }, { operand ? 0 });
+			});
+			[op] ++ operands ++ (0 ! (3 - operands.size));
+		}).flat;
+	}
+
+	checkInputs {
+		if (inputs.at(1).rate != 'audio', {
+			^"driver input is not audio rate: % %".format(inputs.at(1), inputs.at(1).rate);
+		});
+		^this.checkValidInputs;
+	}
+}
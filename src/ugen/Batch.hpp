@@ -0,0 +1,102 @@
+#ifndef SRC_UGEN_BATCH_HPP_
+#define SRC_UGEN_BATCH_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace egSC {
+
+// N lanes of double precision values in one SIMD vector, using the GCC and Clang vector extensions. Arithmetic
+// operators apply lane by lane and accept scalar doubles on either side, so ODE functors written as templates over the
+// value type, using only arithmetic on their arguments and double members, work unchanged for both double and
+// Batch<N>. Such functors are what the batched integrator overloads expect, for example:
+//
+//   struct VanDerPolFunctor {
+//       template<typename T>
+//       T operator()(const T& x, const T& y, const T& yPrime) const {
+//           return ((1.0 - (y * y)) * yPrime) - y;
+//       }
+//   };
+//
+// Functors with parameters that vary from state to state can also provide
+//
+//   template<std::size_t N>
+//   BatchFunctor ForLanes(std::size_t first, std::size_t lanes) const;
+//
+// returning a functor for the lanes states starting at index first, typically with Batch<N> members filled by
+// LoadBatch<N>() from per-state parameter arrays. The batched integrators call it once per batch when it exists.
+//
+// N must be a power of two. Widths beyond the native vector size are legal and are split by the compiler.
+template<std::size_t N>
+struct BatchType {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "Batch width must be a power of two.");
+    typedef double Type __attribute__((vector_size(N * sizeof(double))));
+};
+
+template<std::size_t N>
+using Batch = typename BatchType<N>::Type;
+
+// Loads lanes values from in, for lanes <= N. Unused lanes repeat the first value so they stay finite for any ODE that
+// is finite on the used lanes.
+template<std::size_t N>
+inline Batch<N> LoadBatch(const double* in, std::size_t lanes) {
+    Batch<N> batch = {};
+    if (lanes == N) {
+        std::memcpy(&batch, in, sizeof(batch));
+    } else {
+        for (std::size_t i = 0; i < N; ++i) {
+            batch[i] = in[i < lanes ? i : 0];
+        }
+    }
+    return batch;
+}
+
+// Stores the first lanes values of batch to out, for lanes <= N.
+template<std::size_t N>
+inline void StoreBatch(const Batch<N>& batch, double* out, std::size_t lanes) {
+    if (lanes == N) {
+        std::memcpy(out, &batch, sizeof(batch));
+    } else {
+        for (std::size_t i = 0; i < lanes; ++i) {
+            out[i] = batch[i];
+        }
+    }
+}
+
+// Declares a parameter of type T without deducing T from it. The scalar integrators deduce their value type from the
+// output references only, so inputs of other arithmetic types, like a literal 0 for x, still convert to double.
+template<typename T>
+struct NonDeducedType {
+    typedef T Type;
+};
+
+template<typename T>
+using NonDeduced = typename NonDeducedType<T>::Type;
+
+namespace detail {
+
+template<std::size_t N, typename ODE, typename = void>
+struct HasForLanes : std::false_type {};
+
+template<std::size_t N, typename ODE>
+struct HasForLanes<N, ODE, std::void_t<decltype(std::declval<const ODE&>().template ForLanes<N>(std::size_t(0),
+    std::size_t(0)))>> : std::true_type {};
+
+// Returns the functor to evaluate the lanes states starting at first with, which is f itself unless it provides
+// ForLanes().
+template<std::size_t N, typename ODE>
+inline decltype(auto) ForLanes(const ODE& f, std::size_t first, std::size_t lanes) {
+    if constexpr (HasForLanes<N, ODE>::value) {
+        return f.template ForLanes<N>(first, lanes);
+    } else {
+        return f;
+    }
+}
+
+}    // namespace detail
+
+}    // namespace egSC
+
+#endif    // SRC_UGEN_BATCH_HPP_
@@ -0,0 +1,58 @@
+#ifndef SRC_UGEN_BOGACKI_SHAMPINE_RKNG_3_HPP_
+#define SRC_UGEN_BOGACKI_SHAMPINE_RKNG_3_HPP_
+
+#include "RungeKuttaNystrom.hpp"
+
+#include <cstddef>
+
+namespace egSC {
+
+// Third order Runge-Kutta-Nystrom pair with second order embedded solution for the general second-order ODE. This is
+// the first-order Runge-Kutta pair from:
+// "Bogacki, P. and L.F. Shampine, A 3(2) pair of Runge-Kutta formulas, Applied Mathematics Letters 2 (1989) 321-325"
+// applied to the equivalent first-order system in (y, y'), so aPrime and bPrime are the original Runge-Kutta weights
+// and a and b are their products with the original matrix. Four function evaluations per step.
+struct BogackiShampineRKNG3Tableau {
+    static constexpr std::size_t kStages = 4;
+
+    static constexpr double c[kStages] = { 0.0, 1.0 / 2.0, 3.0 / 4.0, 1.0 };
+
+    static constexpr double a[kStages][kStages] = {
+        { 0.0, 0.0, 0.0, 0.0 },
+        { 0.0, 0.0, 0.0, 0.0 },
+        { 3.0 / 8.0, 0.0, 0.0, 0.0 },
+        { 1.0 / 6.0, 1.0 / 3.0, 0.0, 0.0 }
+    };
+
+    static constexpr double aPrime[kStages][kStages] = {
+        { 0.0, 0.0, 0.0, 0.0 },
+        { 1.0 / 2.0, 0.0, 0.0, 0.0 },
+        { 0.0, 3.0 / 4.0, 0.0, 0.0 },
+        { 2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0.0 }
+    };
+
+    static constexpr double b[kStages] = { 1.0 / 6.0, 1.0 / 3.0, 0.0, 0.0 };
+
+    static constexpr double bPrime[kStages] = { 2.0 / 9.0, 1.0 / 3.0, 4.0 / 9.0, 0.0 };
+
+    static constexpr double bHat[kStages] = { 11.0 / 72.0, 7.0 / 24.0, 1.0 / 18.0, 0.0 };
+
+    static constexpr double bHatPrime[kStages] = { 7.0 / 24.0, 1.0 / 4.0, 1.0 / 3.0, 1.0 / 8.0 };
+};
+
+template<typename ODE, typename T>
+void BogackiShampineRKNG3(const ODE& f, const double h, const NonDeduced<T> x, const NonDeduced<T> y,
+    const NonDeduced<T> yPrime, T& yOut, T& yPrimeOut, T& yHatOut, T& yHatPrimeOut) {
+    RungeKuttaNystrom<BogackiShampineRKNG3Tableau, ODE, T>(f, h, x, y, yPrime, yOut, yPrimeOut, yHatOut, yHatPrimeOut);
+}
+
+template<std::size_t N, typename ODE>
+void BogackiShampineRKNG3(const ODE& f, const double h, const std::size_t count, const double* x, const double* y,
+    const double* yPrime, double* yOut, double* yPrimeOut, double* yHatOut, double* yHatPrimeOut) {
+    RungeKuttaNystrom<N, BogackiShampineRKNG3Tableau, ODE>(f, h, count, x, y, yPrime, yOut, yPrimeOut, yHatOut,
+        yHatPrimeOut);
+}
+
+}    // namespace egSC
+
+#endif    // SRC_UGEN_BOGACKI_SHAMPINE_RKNG_3_HPP_
@@ -0,0 +1,74 @@
+#ifndef SRC_UGEN_DORMAND_PRINCE_RKNG_5_HPP_
+#define SRC_UGEN_DORMAND_PRINCE_RKNG_5_HPP_
+
+#include "RungeKuttaNystrom.hpp"
+
+#include <cstddef>
+
+namespace egSC {
+
+// Fifth order Runge-Kutta-Nystrom pair with fourth order embedded solution for the general second-order ODE. This is
+// the first-order Runge-Kutta pair from:
+// "Dormand, J.R. and P.J. Prince, A family of embedded Runge-Kutta formulae, Journal of Computational and Applied
+//  Mathematics 6 (1980) 19-26"
+// applied to the equivalent first-order system in (y, y'), so aPrime and bPrime are the original Runge-Kutta weights
+// and a and b are their products with the original matrix. Seven function evaluations per step, the last of which
+// only contributes to the embedded solution.
+struct DormandPrinceRKNG5Tableau {
+    static constexpr std::size_t kStages = 7;
+
+    static constexpr double c[kStages] = { 0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0 };
+
+    static constexpr double a[kStages][kStages] = {
+        { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 9.0 / 200.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { -12.0 / 25.0, 4.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { -12248.0 / 6561.0, 7208.0 / 2187.0, -6784.0 / 6561.0, 0.0, 0.0, 0.0, 0.0 },
+        { -533.0 / 264.0, 91.0 / 22.0, -56.0 / 33.0, 7.0 / 88.0, 0.0, 0.0, 0.0 },
+        { 35.0 / 384.0, 0.0, 50.0 / 159.0, 25.0 / 192.0, -243.0 / 6784.0, 0.0, 0.0 }
+    };
+
+    static constexpr double aPrime[kStages][kStages] = {
+        { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 1.0 / 5.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 3.0 / 40.0, 9.0 / 40.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+        { 44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0, 0.0, 0.0, 0.0, 0.0 },
+        { 19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0, 0.0, 0.0, 0.0 },
+        { 9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0, 0.0, 0.0 },
+        { 35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0 }
+    };
+
+    static constexpr double b[kStages] = {
+        35.0 / 384.0, 0.0, 50.0 / 159.0, 25.0 / 192.0, -243.0 / 6784.0, 0.0, 0.0
+    };
+
+    static constexpr double bPrime[kStages] = {
+        35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0
+    };
+
+    static constexpr double bHat[kStages] = {
+        20389.0 / 230400.0, 0.0, 26764.0 / 83475.0, 4609.0 / 38400.0, -43983.0 / 1356800.0, 11.0 / 3360.0, 0.0
+    };
+
+    static constexpr double bHatPrime[kStages] = {
+        5179.0 / 57600.0, 0.0, 7571.0 / 16695.0, 393.0 / 640.0, -92097.0 / 339200.0, 187.0 / 2100.0, 1.0 / 40.0
+    };
+};
+
+template<typename ODE, typename T>
+void DormandPrinceRKNG5(const ODE& f, const double h, const NonDeduced<T> x, const NonDeduced<T> y,
+    const NonDeduced<T> yPrime, T& yOut, T& yPrimeOut, T& yHatOut, T& yHatPrimeOut) {
+    RungeKuttaNystrom<DormandPrinceRKNG5Tableau, ODE, T>(f, h, x, y, yPrime, yOut, yPrimeOut, yHatOut, yHatPrimeOut);
+}
+
+template<std::size_t N, typename ODE>
+void DormandPrinceRKNG5(const ODE& f, const double h, const std::size_t count, const double* x, const double* y,
+    const double* yPrime, double* yOut, double* yPrimeOut, double* yHatOut, double* yHatPrimeOut) {
+    RungeKuttaNystrom<N, DormandPrinceRKNG5Tableau, ODE>(f, h, count, x, y, yPrime, yOut, yPrimeOut, yHatOut,
+        yHatPrimeOut);
+}
+
+}    // namespace egSC
+
+#endif    // SRC_UGEN_DORMAND_PRINCE_RKNG_5_HPP_
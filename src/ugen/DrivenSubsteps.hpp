@@ -0,0 +1,21 @@
+#ifndef SRC_UGEN_DRIVEN_SUBSTEPS_HPP_
+#define SRC_UGEN_DRIVEN_SUBSTEPS_HPP_
+
+#include <cmath>
+
+namespace egSC {
+
+// Plans the integration of an oscillator driven by an audio rate input, which advances one unit of time per audio
+// sample in stepsPerSample equal substeps. The substep count is chosen so that the sample period, with simulation time
+// multiplied by 100K, splits into steps no larger than the largest stable step. step is the fraction of the sample per
+// substep, used to interpolate the driver, and widened to double it is also the integrator step size.
+inline void PlanDrivenSubsteps(const double sampleDur, int& stepsPerSample, float& step) {
+    double samplePeriod = sampleDur * 100000.0;
+    constexpr double kMaxStep = 1.0 / 4.0;
+    stepsPerSample = static_cast<int>(std::ceil(samplePeriod / kMaxStep));
+    step = 1.0 / std::ceil(samplePeriod / kMaxStep);
+}
+
+}    // namespace egSC
+
+#endif    // SRC_UGEN_DRIVEN_SUBSTEPS_HPP_
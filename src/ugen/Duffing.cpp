@@ -6,6 +6,7 @@
 //
 // https://entracte.co.uk/projects/tom-mudd-e226/
 //
+#include "DrivenSubsteps.hpp"
 #include "LinearIntegrator.hpp"
 
 #include "SC_PlugIn.h"
@@ -16,6 +17,10 @@
 static InterfaceTable* ft;
 
 struct DuffingOsc : public Unit {
+    // Simulation time units per second. At control rate the oscillator runs a block size slower, so that a control
+    // period covers as much simulation time as an audio sample does at audio rate.
+    double timeScale;
+
     // Integrator step size per sample, kept so that sampling the oscillator at audio frequencies doesn't require huge
     // adjustments to the gain across the audio range.
     double h;
@@ -37,22 +42,34 @@ struct DuffingExt : public Unit {
 };
 
 static void DuffingOsc_next(DuffingOsc* unit, int inNumSamples);
+static void DuffingOsc_next_k(DuffingOsc* unit, int inNumSamples);
 static void DuffingOsc_Ctor(DuffingOsc* unit);
 static void DuffingExt_next(DuffingExt* unit, int inNumSamples);
+static void DuffingExt_next_k(DuffingExt* unit, int inNumSamples);
 static void DuffingExt_Ctor(DuffingExt* unit);
 
+// Defined in ODEExpr.cpp, which shares this plugin.
+void LoadODEExpr(InterfaceTable* inTable);
+
 PluginLoad(Duffing) {
     ft = inTable;
     DefineSimpleUnit(DuffingOsc);
     DefineSimpleUnit(DuffingExt);
+    LoadODEExpr(inTable);
 }
 
 // == DuffingOsc =======================================================================================================
 
 void DuffingOsc_Ctor(DuffingOsc* unit) {
     // We calibrate the step size so that a 25 kHz oscillator has a 0.25 Hz frequency when simulated with this step size
-    // at the sampling rate. This is the same as multiplying the simulation time by 100K.
-    unit->h = SAMPLEDUR * 100000.0;
+    // at the sampling rate. This is the same as multiplying the simulation time by 100K. At control rate SAMPLEDUR is
+    // the control period, so dividing the time scale by the block size gives the same step size, and the same cost
+    // per control period as per audio sample.
+    unit->timeScale = 100000.0;
+    if (unit->mCalcRate != calc_FullRate) {
+        unit->timeScale /= static_cast<double>(FULLBUFLENGTH);
+    }
+    unit->h = SAMPLEDUR * unit->timeScale;
 
     // Numerical instability results for step sizes larger than this, but as this gets smaller the cost of the
     // compute per sample goes up, so the step size is derived experimentally to be as large as possible while
@@ -65,7 +82,11 @@ void DuffingOsc_Ctor(DuffingOsc* unit) {
     unit->y = 0.0;
     unit->yPrime = 0.0;
 
-    SETCALC(DuffingOsc_next);
+    if (unit->mCalcRate == calc_FullRate) {
+        SETCALC(DuffingOsc_next);
+    } else {
+        SETCALC(DuffingOsc_next_k);
+    }
 }
 
 struct DuffingOscFunctor {
@@ -88,48 +109,71 @@ struct DuffingOscFunctor {
     double m_NonLinearity;
 };
 
-void DuffingOsc_next(DuffingOsc* unit, int inNumSamples) {
-    float* out = OUT(0);
+// Advances the oscillator by numSteps steps of the integrator, resetting it if the solution goes to NaN.
+static inline void DuffingOsc_integrate(const DuffingOscFunctor& f, int numSteps, double step, double& x, double& y,
+    double& yPrime) {
+    for (auto j = 0; j < numSteps; ++j) {
+        double yNext, yPrimeNext;
+        egSC::LinearIntegrator<DuffingOscFunctor>(f, step, x, y, yPrime, yNext, yPrimeNext);
+
+        x += step;
+
+        if (isnan(yNext) || isnan(yPrimeNext)) {
+            x = 0.0;
+            y = 0.0;
+            yPrime = 0.0;
+        } else {
+            y = yNext;
+            yPrime = yPrimeNext;
+        }
+    }
+}
 
+static inline DuffingOscFunctor DuffingOsc_functor(DuffingOsc* unit, double& x) {
     double freq = static_cast<double>(IN0(0));
     double amp = static_cast<double>(IN0(1));
     double damping = static_cast<double>(IN0(2));
     double stiffness = static_cast<double>(IN0(3));
     double nonLinearity = static_cast<double>(IN0(4));
 
-    DuffingOscFunctor f((2.0 * M_PI * freq) / 100000.0, amp, damping, stiffness, nonLinearity);
+    double angularPeriod = unit->timeScale / freq;
+    while (x >= angularPeriod) {
+        x -= angularPeriod;
+    }
+
+    return DuffingOscFunctor((2.0 * M_PI * freq) / unit->timeScale, amp, damping, stiffness, nonLinearity);
+}
+
+void DuffingOsc_next(DuffingOsc* unit, int inNumSamples) {
+    float* out = OUT(0);
 
-    double h = unit->h;
     int stepsPerSample = unit->stepsPerSample;
     double step = unit->step;
     double x = unit->phase;
     double y = unit->y;
     double yPrime = unit->yPrime;
 
-    double angularPeriod = 100000.0 / freq;
-    while (x >= angularPeriod) {
-        x -= angularPeriod;
-    }
+    DuffingOscFunctor f = DuffingOsc_functor(unit, x);
 
     for (auto i = 0; i < inNumSamples; ++i) {
         out[i] = zapgremlins(static_cast<float>(y));
+        DuffingOsc_integrate(f, stepsPerSample, step, x, y, yPrime);
+    }
 
-        for (auto j = 0; j < stepsPerSample; ++j) {
-            double yNext, yPrimeNext;
-            egSC::LinearIntegrator<DuffingOscFunctor>(f, step, x, y, yPrime, yNext, yPrimeNext);
+    unit->phase = x;
+    unit->y = y;
+    unit->yPrime = yPrime;
+}
 
-            x += step;
+void DuffingOsc_next_k(DuffingOsc* unit, int inNumSamples) {
+    double x = unit->phase;
+    double y = unit->y;
+    double yPrime = unit->yPrime;
 
-            if (isnan(yNext) || isnan(yPrimeNext)) {
-                x = 0.0;
-                y = 0.0;
-                yPrime = 0.0;
-            } else {
-                y = yNext;
-                yPrime = yPrimeNext;
-            }
-        }
-    }
+    DuffingOscFunctor f = DuffingOsc_functor(unit, x);
+
+    OUT0(0) = zapgremlins(static_cast<float>(y));
+    DuffingOsc_integrate(f, unit->stepsPerSample, unit->step, x, y, yPrime);
 
     unit->phase = x;
     unit->y = y;
@@ -157,10 +201,9 @@ struct DuffingExtFunctor {
 };
 
 void DuffingExt_Ctor(DuffingExt* unit) {
-    double samplePeriod = SAMPLEDUR * 100000.0;
-    constexpr double kMaxStep = 1.0 / 4.0;
-    unit->stepsPerSample = static_cast<int>(ceil(samplePeriod / kMaxStep));
-    unit->step = 1.0 / ceil(samplePeriod / kMaxStep);
+    // Steps are planned from the audio sample period at both rates, so at control rate the oscillator runs a block size
+    // slower, at the cost per control period that the audio rate version has per sample.
+    egSC::PlanDrivenSubsteps(unit->mWorld->mFullRate.mSampleDur, unit->stepsPerSample, unit->step);
     unit->y = 0.0;
     unit->yPrime = 0.0;
     unit->x0 = 0.0;
@@ -168,7 +211,34 @@ void DuffingExt_Ctor(DuffingExt* unit) {
     unit->x2 = 0.0;
     unit->x3 = 0.0;
 
-    SETCALC(DuffingExt_next);
+    if (unit->mCalcRate == calc_FullRate) {
+        SETCALC(DuffingExt_next);
+    } else {
+        SETCALC(DuffingExt_next_k);
+    }
+}
+
+// Advances the oscillator by one output sample, interpolating the driver across the steps from the four most recent
+// inputs, and resetting if the solution goes to NaN.
+static inline void DuffingExt_integrate(DuffingExtFunctor& f, int stepsPerSample, float step, float x0, float x1,
+    float x2, float x3, double& y, double& yPrime) {
+    double h = static_cast<double>(step);
+    float x = 0.0;
+    for (auto j = 0; j < stepsPerSample; ++j) {
+        double yNext, yPrimeNext;
+        f.m_Driver = static_cast<double>(cubicinterp(x, x0, x1, x2, x3));
+        egSC::LinearIntegrator<DuffingExtFunctor>(f, h, 0.0, y, yPrime, yNext, yPrimeNext);
+
+        x += step;
+
+        if (isnan(yNext) || isnan(yPrimeNext)) {
+            y = 0.0;
+            yPrime = 0.0;
+        } else {
+            y = yNext;
+            yPrime = yPrimeNext;
+        }
+    }
 }
 
 void DuffingExt_next(DuffingExt* unit, int inNumSamples) {
@@ -182,7 +252,6 @@ void DuffingExt_next(DuffingExt* unit, int inNumSamples) {
 
     int stepsPerSample = unit->stepsPerSample;
     float step = unit->step;
-    double doubleStep = static_cast<double>(step);
     double y = unit->y;
     double yPrime = unit->yPrime;
     float x0 = unit->x0;
@@ -196,22 +265,7 @@ void DuffingExt_next(DuffingExt* unit, int inNumSamples) {
         float in_i = in[i];
         out[i] = zapgremlins(static_cast<float>(y));
 
-        float x = 0.0;
-        for (auto j = 0; j < stepsPerSample; ++j) {
-            double yNext, yPrimeNext;
-            f.m_Driver = static_cast<double>(cubicinterp(x, x0, x1, x2, x3));
-            egSC::LinearIntegrator<DuffingExtFunctor>(f, doubleStep, 0.0, y, yPrime, yNext, yPrimeNext);
-
-            x += step;
-
-            if (isnan(yNext) || isnan(yPrimeNext)) {
-                y = 0.0;
-                yPrime = 0.0;
-            } else {
-                y = yNext;
-                yPrime = yPrimeNext;
-            }
-        }
+        DuffingExt_integrate(f, stepsPerSample, step, x0, x1, x2, x3, y, yPrime);
 
         x0 = x1;
         x1 = x2;
@@ -227,3 +281,26 @@ void DuffingExt_next(DuffingExt* unit, int inNumSamples) {
     unit->x3 = x3;
 }
 
+void DuffingExt_next_k(DuffingExt* unit, int inNumSamples) {
+    float in = IN0(0);
+    double damping = static_cast<double>(IN0(1));
+    double stiffness = static_cast<double>(IN0(2));
+    double nonLinearity = static_cast<double>(IN0(3));
+
+    DuffingExtFunctor f(damping, stiffness, nonLinearity);
+
+    double y = unit->y;
+    double yPrime = unit->yPrime;
+
+    // Note 4 control period delay from input.
+    OUT0(0) = zapgremlins(static_cast<float>(y));
+
+    DuffingExt_integrate(f, unit->stepsPerSample, unit->step, unit->x0, unit->x1, unit->x2, unit->x3, y, yPrime);
+
+    unit->y = y;
+    unit->yPrime = yPrime;
+    unit->x0 = unit->x1;
+    unit->x1 = unit->x2;
+    unit->x2 = unit->x3;
+    unit->x3 = in;
+}
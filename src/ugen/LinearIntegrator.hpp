@@ -1,18 +1,40 @@
 #ifndef SRC_UGEN_LINEAR_INTEGRATOR_HPP_
 #define SRC_UGEN_LINEAR_INTEGRATOR_HPP_
 
+#include "Batch.hpp"
+
+#include <cstddef>
+
 namespace egSC {
 
 // General second-order ODE integration solver, assuming linear integration from y'' to y' to y. Not likely to be
-// accurate, particularly for nonsmooth ODEs, but as cheap as it gets at one function eval per sample.
-template<typename ODE>
-void LinearIntegrator(const ODE& f, const double h, const double x, const double y, const double yPrime, double& yOut,
-    double& yPrimeOut) {
-    double yDoublePrime = f(x, y, yPrime);
+// accurate, particularly for nonsmooth ODEs, but as cheap as it gets at one function eval per sample. The value type T
+// is double, or Batch<N> to advance N independent states at once.
+template<typename ODE, typename T>
+void LinearIntegrator(const ODE& f, const double h, const NonDeduced<T> x, const NonDeduced<T> y,
+    const NonDeduced<T> yPrime, T& yOut, T& yPrimeOut) {
+    T yDoublePrime = f(x, y, yPrime);
     yPrimeOut = yPrime + (yDoublePrime * h);
     yOut = y + (yPrimeOut * h);
 }
 
+// Advances count independent states, stored as arrays of x, y, and y', N lanes at a time. The ODE must be vectorizable
+// as described in Batch.hpp, and may provide ForLanes() for per-state parameters. Output arrays may alias the
+// corresponding input arrays.
+template<std::size_t N, typename ODE>
+void LinearIntegrator(const ODE& f, const double h, const std::size_t count, const double* x, const double* y,
+    const double* yPrime, double* yOut, double* yPrimeOut) {
+    for (std::size_t i = 0; i < count; i += N) {
+        std::size_t lanes = count - i < N ? count - i : N;
+        decltype(auto) batchF = detail::ForLanes<N>(f, i, lanes);
+        Batch<N> yNext, yPrimeNext;
+        LinearIntegrator(batchF, h, LoadBatch<N>(x + i, lanes), LoadBatch<N>(y + i, lanes),
+            LoadBatch<N>(yPrime + i, lanes), yNext, yPrimeNext);
+        StoreBatch<N>(yNext, yOut + i, lanes);
+        StoreBatch<N>(yPrimeNext, yPrimeOut + i, lanes);
+    }
+}
+
 }    // namespace egSC
 
 #endif    // SRC_UGEN_LINEAR_INTEGRATOR_HPP_
@@ -0,0 +1,107 @@
+#include "LinearIntegrator.hpp"
+
+#include "VectorizableTestFunctors.hpp"
+
+#include "doctest/doctest.h"
+
+#include <cstddef>
+
+namespace {
+
+// Duffing oscillator with a cosine driver replaced by a polynomial in x, as a vectorizable functor.
+struct DrivenFunctor {
+    template<typename T>
+    T operator()(const T& x, const T& y, const T& yPrime) const {
+        return (m_Amp * (1.0 - (0.5 * x * x))) - (m_Damping * yPrime) - (m_Stiffness * y)
+            - (m_NonLinearity * y * y * y);
+    }
+
+    double m_Amp;
+    double m_Damping;
+    double m_Stiffness;
+    double m_NonLinearity;
+};
+
+}    // namespace
+
+TEST_CASE("LinearIntegrator accepts mixed argument types") {
+    DampedFunctor<double> f{ 0.1 };
+    double y = 1.0;
+    double yPrime = 0.0;
+    double yNext, yPrimeNext;
+    egSC::LinearIntegrator(f, 0.1, 0, y, yPrime, yNext, yPrimeNext);
+    CHECK(yPrimeNext == doctest::Approx(-0.1));
+    CHECK(yNext == doctest::Approx(0.99));
+
+    float yFloat = 1.0f;
+    egSC::LinearIntegrator(f, 0.1, 0, yFloat, 0, yNext, yPrimeNext);
+    CHECK(yNext == doctest::Approx(0.99));
+}
+
+TEST_CASE("LinearIntegrator batched matches scalar") {
+    constexpr std::size_t kCount = 11;
+    constexpr double h = 1.0 / 64.0;
+
+    DrivenFunctor f;
+    f.m_Amp = 0.5;
+    f.m_Damping = 0.1;
+    f.m_Stiffness = 0.5;
+    f.m_NonLinearity = 0.5;
+
+    double x[kCount], y[kCount], yPrime[kCount];
+    double yScalar[kCount], yPrimeScalar[kCount];
+    for (std::size_t i = 0; i < kCount; ++i) {
+        x[i] = 0.0;
+        y[i] = 0.1 * i;
+        yPrime[i] = -0.05 * i;
+        yScalar[i] = y[i];
+        yPrimeScalar[i] = yPrime[i];
+    }
+
+    for (std::size_t step = 0; step < 64; ++step) {
+        egSC::LinearIntegrator<4>(f, h, kCount, x, y, yPrime, y, yPrime);
+
+        for (std::size_t i = 0; i < kCount; ++i) {
+            egSC::LinearIntegrator(f, h, x[i], yScalar[i], yPrimeScalar[i], yScalar[i], yPrimeScalar[i]);
+            x[i] += h;
+        }
+
+        CheckLanesMatch(y, yScalar, kCount);
+        CheckLanesMatch(yPrime, yPrimeScalar, kCount);
+    }
+}
+
+TEST_CASE("LinearIntegrator batched sweeps damping across lanes") {
+    constexpr std::size_t kCount = 11;
+    constexpr double h = 1.0 / 64.0;
+
+    double damping[kCount], x[kCount], y[kCount], yPrime[kCount];
+    double yScalar[kCount], yPrimeScalar[kCount];
+    for (std::size_t i = 0; i < kCount; ++i) {
+        damping[i] = 0.1 * i;
+        x[i] = 0.0;
+        y[i] = 1.0;
+        yPrime[i] = 0.0;
+        yScalar[i] = y[i];
+        yPrimeScalar[i] = yPrime[i];
+    }
+
+    DampingSweepFunctor f{ damping };
+    for (std::size_t step = 0; step < 256; ++step) {
+        egSC::LinearIntegrator<4>(f, h, kCount, x, y, yPrime, y, yPrime);
+
+        for (std::size_t i = 0; i < kCount; ++i) {
+            DampedFunctor<double> fScalar{ damping[i] };
+            egSC::LinearIntegrator(fScalar, h, x[i], yScalar[i], yPrimeScalar[i], yScalar[i], yPrimeScalar[i]);
+            x[i] += h;
+        }
+
+        CheckLanesMatch(y, yScalar, kCount);
+        CheckLanesMatch(yPrime, yPrimeScalar, kCount);
+    }
+
+    // More damping leaves less energy in the oscillator.
+    for (std::size_t i = 1; i < kCount; ++i) {
+        CHECK(((y[i] * y[i]) + (yPrime[i] * yPrime[i])) < ((y[i - 1] * y[i - 1]) + (yPrime[i - 1] * yPrime[i - 1])));
+    }
+}
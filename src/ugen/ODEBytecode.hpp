@@ -0,0 +1,498 @@
+#ifndef SRC_UGEN_ODE_BYTECODE_HPP_
+#define SRC_UGEN_ODE_BYTECODE_HPP_
+
+#include <cmath>
+
+namespace egSC {
+
+// Register bytecode for the right hand side f(x, y, y') of a second-order ODE, compiled from a flat array of
+// instructions so that new equations can be sent from the language at runtime.
+//
+// Each instruction is four numbers: opcode, destination register, operand register a, and operand register b. Unary
+// operations ignore b, and kConst stores the value in a as a literal. Registers kX through kParam3 are inputs and may
+// not be written, and each temporary register must be written exactly once before it is read. The result of the
+// program is the destination of the last instruction.
+//
+// Compile() sorts the instructions by what they depend on, so they can be evaluated at the least frequent rate
+// possible. Uniform instructions depend only on parameters and constants and run once per block in EvaluateUniform().
+// Lane instructions depend on x or the driver input but not the state, so they are known ahead of time for every
+// integration substep in a block, and EvaluateLanes() runs each one across all substeps in a tight loop. Only the
+// remaining state instructions run per function evaluation, in Evaluate().
+class ODEBytecode {
+public:
+    enum Register {
+        kX = 0,
+        kY = 1,
+        kYPrime = 2,
+        kDriver = 3,
+        kParam0 = 4,
+        kParam1 = 5,
+        kParam2 = 6,
+        kParam3 = 7,
+        kFirstTemporary = 8,
+        kNumRegisters = 32
+    };
+    static constexpr int kNumParams = 4;
+
+    enum Opcode {
+        kConst = 0,
+        kAdd = 1,
+        kSub = 2,
+        kMul = 3,
+        kDiv = 4,
+        kNeg = 5,
+        kAbs = 6,
+        kSin = 7,
+        kCos = 8,
+        kTanh = 9,
+        kNumOpcodes = 10
+    };
+
+    // Every instruction writes a temporary that has not been written before, so no valid program is any longer.
+    static constexpr int kMaxInstructions = kNumRegisters - kFirstTemporary;
+
+    // Lane storage rows reserved for the x and driver inputs, which the caller fills before EvaluateLanes().
+    static constexpr int kXSlot = 0;
+    static constexpr int kDriverSlot = 1;
+
+    // Returns false if the code is not a valid program, in which case the object should not be evaluated.
+    bool Compile(const float* code, int size) {
+        if (size <= 0 || (size % 4) != 0 || (size / 4) > kMaxInstructions) {
+            return false;
+        }
+
+        int classes[kNumRegisters];
+        bool written[kNumRegisters];
+        for (auto i = 0; i < kNumRegisters; ++i) {
+            classes[i] = kUniformClass;
+            written[i] = i < kFirstTemporary;
+        }
+        classes[kX] = kLaneClass;
+        classes[kDriver] = kLaneClass;
+        classes[kY] = kStateClass;
+        classes[kYPrime] = kStateClass;
+
+        m_NumUniform = 0;
+        m_NumLane = 0;
+        m_NumState = 0;
+        for (auto i = 0; i < size; i += 4) {
+            Instruction instruction;
+            instruction.a = 0;
+            instruction.b = 0;
+            instruction.constant = 0.0;
+            if (!ReadIndex(code[i], kNumOpcodes, instruction.op)) {
+                return false;
+            }
+            if (!ReadIndex(code[i + 1], kNumRegisters, instruction.dest) || instruction.dest < kFirstTemporary
+                    || written[instruction.dest]) {
+                return false;
+            }
+
+            int instructionClass = kUniformClass;
+            int operands = NumOperands(instruction.op);
+            if (operands == 0) {
+                instruction.constant = static_cast<double>(code[i + 2]);
+            }
+            if (operands >= 1) {
+                if (!ReadOperand(code[i + 2], written, instruction.a)) {
+                    return false;
+                }
+                instructionClass = classes[instruction.a];
+            }
+            if (operands == 2) {
+                if (!ReadOperand(code[i + 3], written, instruction.b)) {
+                    return false;
+                }
+                instructionClass = classes[instruction.b] > instructionClass ? classes[instruction.b] :
+                    instructionClass;
+            }
+
+            written[instruction.dest] = true;
+            classes[instruction.dest] = instructionClass;
+            m_Result = instruction.dest;
+
+            if (instructionClass == kUniformClass) {
+                m_Uniform[m_NumUniform++] = instruction;
+            } else if (instructionClass == kLaneClass) {
+                m_Lane[m_NumLane++] = instruction;
+            } else {
+                m_State[m_NumState++] = { static_cast<unsigned char>(instruction.op),
+                    static_cast<unsigned char>(instruction.dest), static_cast<unsigned char>(instruction.a),
+                    static_cast<unsigned char>(instruction.b), 0 };
+            }
+        }
+
+        FuseStateMultiplies();
+
+        // Assign lane storage rows to every register the lane instructions touch, rewriting their operands as rows.
+        // Uniform operands get rows too, which are filled by broadcasting before the lane instructions run, so that
+        // every lane loop reads and writes only contiguous rows.
+        int slots[kNumRegisters];
+        for (auto i = 0; i < kNumRegisters; ++i) {
+            slots[i] = -1;
+        }
+        slots[kX] = kXSlot;
+        slots[kDriver] = kDriverSlot;
+        m_NumLaneSlots = 2;
+        m_NumBroadcasts = 0;
+        for (auto i = 0; i < m_NumLane; ++i) {
+            Instruction& instruction = m_Lane[i];
+            int operands = NumOperands(instruction.op);
+            if (operands >= 1) {
+                instruction.a = LaneSlot(instruction.a, classes, slots);
+            }
+            if (operands == 2) {
+                instruction.b = LaneSlot(instruction.b, classes, slots);
+            }
+            slots[instruction.dest] = m_NumLaneSlots++;
+            instruction.dest = slots[instruction.dest];
+        }
+
+        // Any lane value the state instructions read, including the result, is loaded into registers per evaluation.
+        m_NumLoads = 0;
+        for (auto i = 0; i < m_NumState; ++i) {
+            const StateInstruction& instruction = m_State[i];
+            int operands = NumOperands(instruction.op);
+            if (operands >= 1) {
+                AddLoad(instruction.a, classes, slots);
+            }
+            if (operands >= 2) {
+                AddLoad(instruction.b, classes, slots);
+            }
+            if (operands == 3) {
+                AddLoad(instruction.c, classes, slots);
+            }
+        }
+        AddLoad(m_Result, classes, slots);
+
+        for (auto i = 0; i < kNumRegisters; ++i) {
+            m_Registers[i] = 0.0;
+        }
+
+        return true;
+    }
+
+    // Number of rows of lane storage needed by EvaluateLanes() and Evaluate().
+    int NumLaneSlots() const { return m_NumLaneSlots; }
+
+    void SetParam(int index, double value) { m_Registers[kParam0 + index] = value; }
+
+    void EvaluateUniform() {
+        for (auto i = 0; i < m_NumUniform; ++i) {
+            const Instruction& instruction = m_Uniform[i];
+            m_Registers[instruction.dest] = Apply(instruction.op, m_Registers[instruction.a],
+                m_Registers[instruction.b], instruction.constant);
+        }
+    }
+
+    // Evaluates the lane instructions for count substeps. Row r of lanes starts at lanes + (r * stride), and the caller
+    // must have filled the first count entries of the kXSlot and kDriverSlot rows.
+    void EvaluateLanes(double* lanes, int stride, int count) const {
+        for (auto i = 0; i < m_NumBroadcasts; ++i) {
+            double* row = lanes + (m_Broadcasts[i].slot * stride);
+            double value = m_Registers[m_Broadcasts[i].reg];
+            for (auto j = 0; j < count; ++j) {
+                row[j] = value;
+            }
+        }
+
+        for (auto i = 0; i < m_NumLane; ++i) {
+            const Instruction& instruction = m_Lane[i];
+            double* out = lanes + (instruction.dest * stride);
+            const double* a = lanes + (instruction.a * stride);
+            const double* b = lanes + (instruction.b * stride);
+            switch (instruction.op) {
+            case kAdd:
+                for (auto j = 0; j < count; ++j) { out[j] = a[j] + b[j]; }
+                break;
+            case kSub:
+                for (auto j = 0; j < count; ++j) { out[j] = a[j] - b[j]; }
+                break;
+            case kMul:
+                for (auto j = 0; j < count; ++j) { out[j] = a[j] * b[j]; }
+                break;
+            case kDiv:
+                for (auto j = 0; j < count; ++j) { out[j] = a[j] / b[j]; }
+                break;
+            case kNeg:
+                for (auto j = 0; j < count; ++j) { out[j] = -a[j]; }
+                break;
+            case kAbs:
+                for (auto j = 0; j < count; ++j) { out[j] = std::fabs(a[j]); }
+                break;
+            case kSin:
+                for (auto j = 0; j < count; ++j) { out[j] = std::sin(a[j]); }
+                break;
+            case kCos:
+                for (auto j = 0; j < count; ++j) { out[j] = std::cos(a[j]); }
+                break;
+            case kTanh:
+                for (auto j = 0; j < count; ++j) { out[j] = std::tanh(a[j]); }
+                break;
+            }
+        }
+    }
+
+    // Returns f(x, y, y') for the substep lane of the most recent EvaluateLanes() call on lanes.
+    double Evaluate(const double* lanes, int stride, int lane, double y, double yPrime) {
+        double* registers = m_Registers;
+        registers[kY] = y;
+        registers[kYPrime] = yPrime;
+        for (auto i = 0; i < m_NumLoads; ++i) {
+            registers[m_Loads[i].reg] = lanes[(m_Loads[i].slot * stride) + lane];
+        }
+        const StateInstruction* instruction = m_State;
+        const StateInstruction* end = m_State + m_NumState;
+        for (; instruction != end; ++instruction) {
+            double a = registers[instruction->a];
+            double b = registers[instruction->b];
+            double result;
+            switch (instruction->op) {
+            case kMulAdd:
+                result = registers[instruction->c] + (a * b);
+                break;
+            case kMulSub:
+                result = registers[instruction->c] - (a * b);
+                break;
+            case kAdd:
+                result = a + b;
+                break;
+            case kSub:
+                result = a - b;
+                break;
+            case kMul:
+                result = a * b;
+                break;
+            case kDiv:
+                result = a / b;
+                break;
+            case kNeg:
+                result = -a;
+                break;
+            case kAbs:
+                result = std::fabs(a);
+                break;
+            case kSin:
+                result = std::sin(a);
+                break;
+            case kCos:
+                result = std::cos(a);
+                break;
+            default:
+                result = std::tanh(a);
+                break;
+            }
+            registers[instruction->dest] = result;
+        }
+        return registers[m_Result];
+    }
+
+private:
+    enum Class { kUniformClass = 0, kLaneClass = 1, kStateClass = 2 };
+
+    // Internal opcodes produced by FuseStateMultiplies(), computing c + (a * b) and c - (a * b).
+    enum FusedOpcode { kMulAdd = kNumOpcodes, kMulSub = kNumOpcodes + 1 };
+
+    struct Instruction {
+        int op;
+        int dest;
+        int a;
+        int b;
+        double constant;
+    };
+
+    // Constants are always uniform, so state instructions only need register operands, packed small to keep the
+    // per-evaluation loop compact. Only the fused opcodes read c.
+    struct StateInstruction {
+        unsigned char op;
+        unsigned char dest;
+        unsigned char a;
+        unsigned char b;
+        unsigned char c;
+    };
+
+    struct SlotMapping {
+        int reg;
+        int slot;
+    };
+
+    static int NumOperands(int op) {
+        if (op == kConst) {
+            return 0;
+        }
+        if (op <= kDiv) {
+            return 2;
+        }
+        if (op >= kNumOpcodes) {
+            return 3;
+        }
+        return 1;
+    }
+
+    // Every state instruction costs a dispatch per function evaluation, so fold each state multiply whose result is
+    // only read once, by an add or subtract, into that instruction. Registers are only written once, so the multiply
+    // operands still hold the same values at the point of use.
+    void FuseStateMultiplies() {
+        int reads[kNumRegisters];
+        int producers[kNumRegisters];
+        for (auto i = 0; i < kNumRegisters; ++i) {
+            reads[i] = 0;
+            producers[i] = -1;
+        }
+        for (auto i = 0; i < m_NumState; ++i) {
+            const StateInstruction& instruction = m_State[i];
+            int operands = NumOperands(instruction.op);
+            if (operands >= 1) {
+                ++reads[instruction.a];
+            }
+            if (operands == 2) {
+                ++reads[instruction.b];
+            }
+            producers[instruction.dest] = i;
+        }
+        ++reads[m_Result];
+
+        bool fused[kMaxInstructions];
+        for (auto i = 0; i < m_NumState; ++i) {
+            fused[i] = false;
+        }
+        for (auto i = 0; i < m_NumState; ++i) {
+            StateInstruction& instruction = m_State[i];
+            if (instruction.op != kAdd && instruction.op != kSub) {
+                continue;
+            }
+            // Addition commutes, so either operand may be the product, but subtraction only fuses c - (a * b).
+            int product = instruction.b;
+            int other = instruction.a;
+            if (instruction.op == kAdd && !IsFusableMultiply(product, reads, producers)) {
+                product = instruction.a;
+                other = instruction.b;
+            }
+            if (!IsFusableMultiply(product, reads, producers)) {
+                continue;
+            }
+            const StateInstruction& multiply = m_State[producers[product]];
+            instruction = { static_cast<unsigned char>(instruction.op == kAdd ? kMulAdd : kMulSub), instruction.dest,
+                multiply.a, multiply.b, static_cast<unsigned char>(other) };
+            fused[producers[product]] = true;
+        }
+
+        int numState = 0;
+        for (auto i = 0; i < m_NumState; ++i) {
+            if (!fused[i]) {
+                m_State[numState++] = m_State[i];
+            }
+        }
+        m_NumState = numState;
+    }
+
+    bool IsFusableMultiply(int reg, const int* reads, const int* producers) const {
+        return producers[reg] >= 0 && m_State[producers[reg]].op == kMul && reads[reg] == 1;
+    }
+
+    // Converts code to an integer index in [0, limit), checking the range before the conversion as casting a NaN,
+    // infinite, or out of range float to int is undefined.
+    static bool ReadIndex(float code, int limit, int& index) {
+        if (!std::isfinite(code) || code < 0.0f || code >= static_cast<float>(limit) || code != std::floor(code)) {
+            return false;
+        }
+        index = static_cast<int>(code);
+        return true;
+    }
+
+    static bool ReadOperand(float code, const bool* written, int& reg) {
+        return ReadIndex(code, kNumRegisters, reg) && written[reg];
+    }
+
+    static inline double Apply(int op, double a, double b, double constant) {
+        switch (op) {
+        case kConst:
+            return constant;
+        case kAdd:
+            return a + b;
+        case kSub:
+            return a - b;
+        case kMul:
+            return a * b;
+        case kDiv:
+            return a / b;
+        case kNeg:
+            return -a;
+        case kAbs:
+            return std::fabs(a);
+        case kSin:
+            return std::sin(a);
+        case kCos:
+            return std::cos(a);
+        case kTanh:
+            return std::tanh(a);
+        }
+        return 0.0;
+    }
+
+    int LaneSlot(int reg, const int* classes, int* slots) {
+        if (slots[reg] < 0) {
+            slots[reg] = m_NumLaneSlots++;
+            if (classes[reg] == kUniformClass) {
+                m_Broadcasts[m_NumBroadcasts++] = { reg, slots[reg] };
+            }
+        }
+        return slots[reg];
+    }
+
+    void AddLoad(int reg, const int* classes, const int* slots) {
+        if (classes[reg] != kLaneClass) {
+            return;
+        }
+        for (auto i = 0; i < m_NumLoads; ++i) {
+            if (m_Loads[i].reg == reg) {
+                return;
+            }
+        }
+        m_Loads[m_NumLoads++] = { reg, slots[reg] };
+    }
+
+    Instruction m_Uniform[kMaxInstructions];
+    Instruction m_Lane[kMaxInstructions];
+    StateInstruction m_State[kMaxInstructions];
+    int m_NumUniform;
+    int m_NumLane;
+    int m_NumState;
+
+    SlotMapping m_Broadcasts[kNumRegisters];
+    SlotMapping m_Loads[kNumRegisters];
+    int m_NumBroadcasts;
+    int m_NumLoads;
+    int m_NumLaneSlots;
+
+    int m_Result;
+    double m_Registers[kNumRegisters];
+};
+
+// Evaluates the program at the substep given by m_Lane, reading x and the driver from lane storage filled in ahead of
+// time. The x argument is ignored, so this can only drive integrators that evaluate the ODE once at the start of each
+// substep, like LinearIntegrator, and not Runge-Kutta-Nystrom pairs with their intermediate stage nodes, which reject
+// it at compile time through kIgnoresX.
+struct ODEBytecodeFunctor {
+    static constexpr bool kIgnoresX = true;
+
+    ODEBytecodeFunctor(ODEBytecode* program, const double* lanes, int stride) :
+            m_Program(program),
+            m_Lanes(lanes),
+            m_Stride(stride),
+            m_Lane(0) {
+    }
+
+    double operator()(double x, double y, double yPrime) const {
+        return m_Program->Evaluate(m_Lanes, m_Stride, m_Lane, y, yPrime);
+    }
+
+    ODEBytecode* m_Program;
+    const double* m_Lanes;
+    int m_Stride;
+    int m_Lane;
+};
+
+}    // namespace egSC
+
+#endif    // SRC_UGEN_ODE_BYTECODE_HPP_
@@ -0,0 +1,112 @@
+// Microbenchmark comparing an ODEBytecode program against the equivalent hand-written functor, integrating the
+// externally driven Duffing oscillator in audio blocks the way ODEExpr and DuffingExt do. Build with
+// CMAKE_BUILD_TYPE=Release for meaningful numbers.
+#include "LinearIntegrator.hpp"
+#include "ODEBytecode.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+
+using egSC::ODEBytecode;
+
+struct DuffingExtFunctor {
+    double operator()(double x, double y, double yPrime) const {
+        return m_Driver - (m_Damping * yPrime) - (m_Stiffness * y) - (m_NonLinearity * y * y * y);
+    }
+
+    double m_Driver;
+    double m_Damping;
+    double m_Stiffness;
+    double m_NonLinearity;
+};
+
+const float kDuffingProgram[] = {
+    ODEBytecode::kMul, 8, ODEBytecode::kParam0, ODEBytecode::kYPrime,
+    ODEBytecode::kSub, 9, ODEBytecode::kDriver, 8,
+    ODEBytecode::kMul, 10, ODEBytecode::kParam1, ODEBytecode::kY,
+    ODEBytecode::kSub, 11, 9, 10,
+    ODEBytecode::kMul, 12, ODEBytecode::kParam2, ODEBytecode::kY,
+    ODEBytecode::kMul, 13, 12, ODEBytecode::kY,
+    ODEBytecode::kMul, 14, 13, ODEBytecode::kY,
+    ODEBytecode::kSub, 15, 11, 14
+};
+
+constexpr int kBlockSize = 64;
+constexpr int kStepsPerSample = 9;
+constexpr int kSubsteps = kBlockSize * kStepsPerSample;
+constexpr int kBlocks = 20000;
+constexpr double kStep = 1.0 / kStepsPerSample;
+
+// Driver values for each substep of a block, as interpolated from the input.
+void FillDriver(int block, double* driver) {
+    for (auto i = 0; i < kSubsteps; ++i) {
+        driver[i] = std::sin(0.001 * ((block * kSubsteps) + i));
+    }
+}
+
+double BenchFunctor(double& y) {
+    DuffingExtFunctor f;
+    f.m_Damping = 0.1;
+    f.m_Stiffness = 0.5;
+    f.m_NonLinearity = 0.5;
+    std::vector<double> driver(kSubsteps);
+    double yPrime = 0.0;
+    y = 0.0;
+
+    double nanos = 0.0;
+    for (auto block = 0; block < kBlocks; ++block) {
+        FillDriver(block, driver.data());
+        auto start = std::chrono::steady_clock::now();
+        for (auto i = 0; i < kSubsteps; ++i) {
+            f.m_Driver = driver[i];
+            egSC::LinearIntegrator(f, kStep, 0.0, y, yPrime, y, yPrime);
+        }
+        auto end = std::chrono::steady_clock::now();
+        nanos += std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    return nanos / (kBlocks * kSubsteps);
+}
+
+double BenchBytecode(double& y) {
+    ODEBytecode program;
+    program.Compile(kDuffingProgram, sizeof(kDuffingProgram) / sizeof(float));
+    std::vector<double> lanes(program.NumLaneSlots() * kSubsteps);
+    double* driver = lanes.data() + (ODEBytecode::kDriverSlot * kSubsteps);
+    double yPrime = 0.0;
+    y = 0.0;
+
+    double nanos = 0.0;
+    for (auto block = 0; block < kBlocks; ++block) {
+        FillDriver(block, driver);
+        auto start = std::chrono::steady_clock::now();
+        program.SetParam(0, 0.1);
+        program.SetParam(1, 0.5);
+        program.SetParam(2, 0.5);
+        program.EvaluateUniform();
+        program.EvaluateLanes(lanes.data(), kSubsteps, kSubsteps);
+        egSC::ODEBytecodeFunctor f(&program, lanes.data(), kSubsteps);
+        for (auto i = 0; i < kSubsteps; ++i) {
+            f.m_Lane = i;
+            egSC::LinearIntegrator(f, kStep, 0.0, y, yPrime, y, yPrime);
+        }
+        auto end = std::chrono::steady_clock::now();
+        nanos += std::chrono::duration<double, std::nano>(end - start).count();
+    }
+    return nanos / (kBlocks * kSubsteps);
+}
+
+}    // namespace
+
+int main(int argc, char* argv[]) {
+    double yFunctor, yBytecode;
+    double functor = BenchFunctor(yFunctor);
+    double bytecode = BenchBytecode(yBytecode);
+    std::printf("%-24s %8.3f ns/step (y = %f)\n", "DuffingExtFunctor", functor, yFunctor);
+    std::printf("%-24s %8.3f ns/step (y = %f)\n", "ODEBytecode", bytecode, yBytecode);
+    std::printf("%-24s %8.3f\n", "ratio", bytecode / functor);
+    return 0;
+}
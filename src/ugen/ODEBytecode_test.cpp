@@ -0,0 +1,220 @@
+#include "ODEBytecode.hpp"
+
+#include "LinearIntegrator.hpp"
+#include "RungeKuttaNystrom.hpp"
+
+#include "doctest/doctest.h"
+
+#include <cmath>
+
+namespace {
+
+using egSC::ODEBytecode;
+
+// f(x, y, y') = driver - (damping * y') - (stiffness * y) - (nonLinearity * y * y * y), with the parameters in order.
+const float kDuffingProgram[] = {
+    ODEBytecode::kMul, 8, ODEBytecode::kParam0, ODEBytecode::kYPrime,
+    ODEBytecode::kSub, 9, ODEBytecode::kDriver, 8,
+    ODEBytecode::kMul, 10, ODEBytecode::kParam1, ODEBytecode::kY,
+    ODEBytecode::kSub, 11, 9, 10,
+    ODEBytecode::kMul, 12, ODEBytecode::kParam2, ODEBytecode::kY,
+    ODEBytecode::kMul, 13, 12, ODEBytecode::kY,
+    ODEBytecode::kMul, 14, 13, ODEBytecode::kY,
+    ODEBytecode::kSub, 15, 11, 14
+};
+
+struct DuffingFunctor {
+    double operator()(double x, double y, double yPrime) const {
+        return m_Driver - (m_Damping * yPrime) - (m_Stiffness * y) - (m_NonLinearity * y * y * y);
+    }
+
+    double m_Driver;
+    double m_Damping;
+    double m_Stiffness;
+    double m_NonLinearity;
+};
+
+// The functor reads x from lane storage, so it must not be accepted by the Runge-Kutta-Nystrom pairs.
+static_assert(egSC::detail::IgnoresX<egSC::ODEBytecodeFunctor>::value, "ODEBytecodeFunctor must declare kIgnoresX.");
+static_assert(!egSC::detail::IgnoresX<DuffingFunctor>::value, "Functors evaluate at x by default.");
+
+}    // namespace
+
+TEST_CASE("ODEBytecode rejects malformed programs") {
+    ODEBytecode program;
+
+    // Empty or truncated.
+    CHECK_FALSE(program.Compile(kDuffingProgram, 0));
+    CHECK_FALSE(program.Compile(kDuffingProgram, 3));
+
+    // Unknown opcode.
+    const float badOpcode[] = { 42, 8, 0, 0 };
+    CHECK_FALSE(program.Compile(badOpcode, 4));
+
+    // Writes an input register.
+    const float writesInput[] = { ODEBytecode::kAdd, ODEBytecode::kY, ODEBytecode::kY, ODEBytecode::kY };
+    CHECK_FALSE(program.Compile(writesInput, 4));
+
+    // Reads a temporary before writing it.
+    const float readsUnwritten[] = { ODEBytecode::kAdd, 8, 9, ODEBytecode::kY };
+    CHECK_FALSE(program.Compile(readsUnwritten, 4));
+
+    // Writes a temporary twice.
+    const float writesTwice[] = { ODEBytecode::kConst, 8, 1, 0, ODEBytecode::kConst, 8, 2, 0 };
+    CHECK_FALSE(program.Compile(writesTwice, 8));
+
+    // Register out of range.
+    const float outOfRange[] = { ODEBytecode::kNeg, ODEBytecode::kNumRegisters, ODEBytecode::kY, 0 };
+    CHECK_FALSE(program.Compile(outOfRange, 4));
+
+    // Values that cannot be converted to int, in every position that holds an opcode or register.
+    const float notIndices[] = { NAN, INFINITY, -INFINITY, 1e10f, -1e10f, 2.5f };
+    for (auto value : notIndices) {
+        const float badOp[] = { value, 8, ODEBytecode::kY, ODEBytecode::kY };
+        CHECK_FALSE(program.Compile(badOp, 4));
+        const float badDest[] = { ODEBytecode::kAdd, value, ODEBytecode::kY, ODEBytecode::kY };
+        CHECK_FALSE(program.Compile(badDest, 4));
+        const float badA[] = { ODEBytecode::kAdd, 8, value, ODEBytecode::kY };
+        CHECK_FALSE(program.Compile(badA, 4));
+        const float badB[] = { ODEBytecode::kAdd, 8, ODEBytecode::kY, value };
+        CHECK_FALSE(program.Compile(badB, 4));
+    }
+
+    // A constant may hold any value, as its operand is a literal rather than a register.
+    const float nanConstant[] = { ODEBytecode::kConst, 8, NAN, 0 };
+    CHECK(program.Compile(nanConstant, 4));
+
+    CHECK(program.Compile(kDuffingProgram, sizeof(kDuffingProgram) / sizeof(float)));
+}
+
+TEST_CASE("ODEBytecode accepts programs up to one instruction per temporary") {
+    ODEBytecode program;
+
+    // Sums y once into every temporary, which is the longest valid program.
+    float code[(ODEBytecode::kMaxInstructions + 1) * 4];
+    for (auto i = 0; i < ODEBytecode::kMaxInstructions; ++i) {
+        code[(i * 4) + 0] = ODEBytecode::kAdd;
+        code[(i * 4) + 1] = ODEBytecode::kFirstTemporary + i;
+        code[(i * 4) + 2] = i == 0 ? ODEBytecode::kY : ODEBytecode::kFirstTemporary + i - 1;
+        code[(i * 4) + 3] = ODEBytecode::kY;
+    }
+    REQUIRE(program.Compile(code, ODEBytecode::kMaxInstructions * 4));
+    CHECK(program.Evaluate(nullptr, 0, 0, 1.0, 0.0) == doctest::Approx(ODEBytecode::kMaxInstructions + 1.0));
+
+    code[(ODEBytecode::kMaxInstructions * 4) + 0] = ODEBytecode::kNeg;
+    code[(ODEBytecode::kMaxInstructions * 4) + 1] = ODEBytecode::kFirstTemporary;
+    code[(ODEBytecode::kMaxInstructions * 4) + 2] = ODEBytecode::kY;
+    code[(ODEBytecode::kMaxInstructions * 4) + 3] = 0;
+    CHECK_FALSE(program.Compile(code, (ODEBytecode::kMaxInstructions + 1) * 4));
+}
+
+TEST_CASE("ODEBytecode Duffing program matches hand-written functor") {
+    ODEBytecode program;
+    REQUIRE(program.Compile(kDuffingProgram, sizeof(kDuffingProgram) / sizeof(float)));
+
+    DuffingFunctor f;
+    f.m_Damping = 0.1;
+    f.m_Stiffness = 0.5;
+    f.m_NonLinearity = 0.5;
+    program.SetParam(0, f.m_Damping);
+    program.SetParam(1, f.m_Stiffness);
+    program.SetParam(2, f.m_NonLinearity);
+    program.EvaluateUniform();
+
+    constexpr int kLanes = 64;
+    const int stride = kLanes;
+    double lanes[kLanes * 16];
+    REQUIRE(program.NumLaneSlots() <= 16);
+    for (auto i = 0; i < kLanes; ++i) {
+        lanes[(ODEBytecode::kXSlot * stride) + i] = 0.0;
+        lanes[(ODEBytecode::kDriverSlot * stride) + i] = std::sin(0.1 * i);
+    }
+    program.EvaluateLanes(lanes, stride, kLanes);
+
+    egSC::ODEBytecodeFunctor g(&program, lanes, stride);
+    double y = 0.0;
+    double yPrime = 0.0;
+    double yExpected = 0.0;
+    double yPrimeExpected = 0.0;
+    constexpr double h = 0.25;
+    for (auto i = 0; i < kLanes; ++i) {
+        f.m_Driver = lanes[(ODEBytecode::kDriverSlot * stride) + i];
+        g.m_Lane = i;
+        CHECK(g(0.0, y, yPrime) == doctest::Approx(f(0.0, y, yPrime)));
+
+        egSC::LinearIntegrator(f, h, 0.0, yExpected, yPrimeExpected, yExpected, yPrimeExpected);
+        egSC::LinearIntegrator(g, h, 0.0, y, yPrime, y, yPrime);
+        CHECK(y == doctest::Approx(yExpected));
+        CHECK(yPrime == doctest::Approx(yPrimeExpected));
+    }
+}
+
+TEST_CASE("ODEBytecode evaluates uniform, lane, and state instructions") {
+    // f(x, y, y') = (2 * cos(x)) - y', which mixes all three instruction classes, including a uniform constant used by
+    // a lane instruction.
+    const float code[] = {
+        ODEBytecode::kConst, 8, 2, 0,
+        ODEBytecode::kCos, 9, ODEBytecode::kX, 0,
+        ODEBytecode::kMul, 10, 8, 9,
+        ODEBytecode::kSub, 11, 10, ODEBytecode::kYPrime
+    };
+
+    ODEBytecode program;
+    REQUIRE(program.Compile(code, sizeof(code) / sizeof(float)));
+    program.EvaluateUniform();
+
+    constexpr int kLanes = 8;
+    const int stride = kLanes;
+    double lanes[kLanes * 8];
+    REQUIRE(program.NumLaneSlots() <= 8);
+    for (auto i = 0; i < kLanes; ++i) {
+        lanes[(ODEBytecode::kXSlot * stride) + i] = 0.5 * i;
+        lanes[(ODEBytecode::kDriverSlot * stride) + i] = 0.0;
+    }
+    program.EvaluateLanes(lanes, stride, kLanes);
+
+    for (auto i = 0; i < kLanes; ++i) {
+        double x = 0.5 * i;
+        CHECK(program.Evaluate(lanes, stride, i, 1.0, 0.25) == doctest::Approx((2.0 * std::cos(x)) - 0.25));
+    }
+}
+
+TEST_CASE("ODEBytecode fused multiplies match unfused evaluation") {
+    // f(x, y, y') = (y * y') + ((y' * 3) - (y * y)) + (2 - (y' * y')) - ((y * 5) - y'), where the multiplies feed adds
+    // from either side, a subtraction from the right, a subtraction from the left that must not fuse, and one product
+    // that is read twice.
+    const float code[] = {
+        ODEBytecode::kConst, 8, 3, 0,
+        ODEBytecode::kConst, 9, 2, 0,
+        ODEBytecode::kConst, 10, 5, 0,
+        ODEBytecode::kMul, 11, ODEBytecode::kY, ODEBytecode::kYPrime,
+        ODEBytecode::kMul, 12, ODEBytecode::kYPrime, 8,
+        ODEBytecode::kMul, 13, ODEBytecode::kY, ODEBytecode::kY,
+        ODEBytecode::kSub, 14, 12, 13,
+        ODEBytecode::kAdd, 15, 11, 14,
+        ODEBytecode::kMul, 16, ODEBytecode::kYPrime, ODEBytecode::kYPrime,
+        ODEBytecode::kSub, 17, 9, 16,
+        ODEBytecode::kAdd, 18, 15, 17,
+        ODEBytecode::kMul, 19, ODEBytecode::kY, 10,
+        ODEBytecode::kSub, 20, 19, ODEBytecode::kYPrime,
+        ODEBytecode::kSub, 21, 18, 20,
+        ODEBytecode::kMul, 22, ODEBytecode::kY, 8,
+        ODEBytecode::kAdd, 23, 22, 22,
+        ODEBytecode::kAdd, 24, 21, 23
+    };
+
+    ODEBytecode program;
+    REQUIRE(program.Compile(code, sizeof(code) / sizeof(float)));
+    program.EvaluateUniform();
+
+    double lanes[2] = { 0.0, 0.0 };
+    program.EvaluateLanes(lanes, 1, 1);
+
+    for (auto i = 0; i < 16; ++i) {
+        double y = -2.0 + (0.25 * i);
+        double yPrime = 1.5 - (0.125 * i);
+        double expected = (y * yPrime) + ((yPrime * 3.0) - (y * y)) + (2.0 - (yPrime * yPrime)) - ((y * 5.0) - yPrime)
+            + ((y * 3.0) + (y * 3.0));
+        CHECK(program.Evaluate(lanes, 1, 0, y, yPrime) == doctest::Approx(expected));
+    }
+}
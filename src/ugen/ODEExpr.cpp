@@ -0,0 +1,166 @@
+// Externally driven oscillator integrating a user-supplied second-order ODE, with the right hand side sent from the
+// language as a buffer of ODEBytecode instructions. Step planning and driver interpolation follow DuffingExt, and the
+// UGen is registered from the Duffing plugin load function.
+//
+#include "DrivenSubsteps.hpp"
+#include "LinearIntegrator.hpp"
+#include "ODEBytecode.hpp"
+
+#include "SC_PlugIn.h"
+
+#include <math.h>
+
+static InterfaceTable* ft;
+
+// The program sees x as time in samples since the UGen started. It is rebuilt for every substep from an integer sample
+// count, rather than accumulated, and the count wraps back to zero after this many samples, about six minutes at 48kHz,
+// so x stays small enough that sin and cos of it keep their precision.
+static constexpr int kXPeriod = 1 << 24;
+
+struct ODEExpr : public Unit {
+    // Program buffer, named as GET_BUF_SHARED expects.
+    float m_fbufnum;
+    SndBuf* m_buf;
+
+    egSC::ODEBytecode program;
+
+    // Lane storage for the program, one row of stepsPerSample * BUFLENGTH substeps per lane slot.
+    double* lanes;
+    int stride;
+
+    int stepsPerSample;
+    float step;
+    double h;
+    int sample;
+    double y, yPrime;
+    float x0, x1, x2, x3;
+};
+
+static void ODEExpr_next(ODEExpr* unit, int inNumSamples);
+static void ODEExpr_Ctor(ODEExpr* unit);
+static void ODEExpr_Dtor(ODEExpr* unit);
+
+void LoadODEExpr(InterfaceTable* inTable) {
+    ft = inTable;
+    DefineDtorUnit(ODEExpr);
+}
+
+void ODEExpr_Ctor(ODEExpr* unit) {
+    unit->lanes = nullptr;
+    unit->m_fbufnum = -1e9f;
+
+    // The program is copied out of the buffer, so the shared lock is only held while compiling.
+    bool compiled;
+    {
+        GET_BUF_SHARED
+        compiled = bufData && unit->program.Compile(bufData, static_cast<int>(bufSamples));
+    }
+    if (!compiled) {
+        Print("ODEExpr: buffer %d does not contain a valid program.\n", static_cast<int>(unit->m_fbufnum));
+        SETCALC(*ClearUnitOutputs);
+        ClearUnitOutputs(unit, 1);
+        return;
+    }
+
+    egSC::PlanDrivenSubsteps(SAMPLEDUR, unit->stepsPerSample, unit->step);
+    unit->h = static_cast<double>(unit->step);
+
+    unit->stride = unit->stepsPerSample * BUFLENGTH;
+    unit->lanes = static_cast<double*>(RTAlloc(unit->mWorld,
+        unit->program.NumLaneSlots() * unit->stride * sizeof(double)));
+    if (!unit->lanes) {
+        Print("ODEExpr: unable to allocate lane storage.\n");
+        SETCALC(*ClearUnitOutputs);
+        ClearUnitOutputs(unit, 1);
+        return;
+    }
+
+    unit->sample = 0;
+    unit->y = 0.0;
+    unit->yPrime = 0.0;
+    unit->x0 = 0.0;
+    unit->x1 = 0.0;
+    unit->x2 = 0.0;
+    unit->x3 = 0.0;
+
+    SETCALC(ODEExpr_next);
+}
+
+void ODEExpr_Dtor(ODEExpr* unit) {
+    if (unit->lanes) {
+        RTFree(unit->mWorld, unit->lanes);
+    }
+}
+
+void ODEExpr_next(ODEExpr* unit, int inNumSamples) {
+    float* out = OUT(0);
+    float* in = IN(1);
+
+    egSC::ODEBytecode& program = unit->program;
+    for (auto i = 0; i < egSC::ODEBytecode::kNumParams; ++i) {
+        program.SetParam(i, static_cast<double>(IN0(2 + i)));
+    }
+    program.EvaluateUniform();
+
+    int stepsPerSample = unit->stepsPerSample;
+    float step = unit->step;
+    double h = unit->h;
+    double* lanes = unit->lanes;
+    int stride = unit->stride;
+    float x0 = unit->x0;
+    float x1 = unit->x1;
+    float x2 = unit->x2;
+    float x3 = unit->x3;
+
+    // Everything but the state is known ahead of time, so fill in x and the interpolated driver for every substep in
+    // the block and evaluate the state-independent part of the program across all of them at once. This also reads
+    // all of the input before any output is written, as they may be the same buffer. Note 4 sample delay from input.
+    double* xLane = lanes + (egSC::ODEBytecode::kXSlot * stride);
+    double* driverLane = lanes + (egSC::ODEBytecode::kDriverSlot * stride);
+    int sample = unit->sample;
+    for (auto i = 0; i < inNumSamples; ++i) {
+        float frac = 0.0;
+        for (auto j = 0; j < stepsPerSample; ++j) {
+            *xLane++ = static_cast<double>(sample) + (j * h);
+            *driverLane++ = static_cast<double>(cubicinterp(frac, x0, x1, x2, x3));
+            frac += step;
+        }
+        sample = (sample + 1) & (kXPeriod - 1);
+
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+        x3 = in[i];
+    }
+    program.EvaluateLanes(lanes, stride, inNumSamples * stepsPerSample);
+
+    egSC::ODEBytecodeFunctor f(&program, lanes, stride);
+    double y = unit->y;
+    double yPrime = unit->yPrime;
+    for (auto i = 0; i < inNumSamples; ++i) {
+        out[i] = zapgremlins(static_cast<float>(y));
+
+        for (auto j = 0; j < stepsPerSample; ++j) {
+            double yNext, yPrimeNext;
+            egSC::LinearIntegrator<egSC::ODEBytecodeFunctor>(f, h, 0.0, y, yPrime, yNext, yPrimeNext);
+
+            ++f.m_Lane;
+
+            if (isnan(yNext) || isnan(yPrimeNext)) {
+                y = 0.0;
+                yPrime = 0.0;
+            } else {
+                y = yNext;
+                yPrime = yPrimeNext;
+            }
+        }
+    }
+
+    unit->sample = sample;
+    unit->y = y;
+    unit->yPrime = yPrime;
+    unit->x0 = x0;
+    unit->x1 = x1;
+    unit->x2 = x2;
+    unit->x3 = x3;
+}
@@ -0,0 +1,213 @@
+#ifndef SRC_UGEN_RUNGE_KUTTA_NYSTROM_HPP_
+#define SRC_UGEN_RUNGE_KUTTA_NYSTROM_HPP_
+
+#include "Batch.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+namespace egSC {
+
+// Generic explicit embedded Runge-Kutta-Nystrom solver for the general second-order ODE y'' = f(x, y, y'). The method
+// is described by a Tableau type with only static constexpr members:
+//
+//   kStages                          number of function evaluations per step
+//   c[kStages]                       stage nodes
+//   a[kStages][kStages]              stage weights for y, scaled by h^2
+//   aPrime[kStages][kStages]         stage weights for y', scaled by h
+//   b, bPrime[kStages]               output weights for y and y'
+//   bHat, bHatPrime[kStages]         embedded output weights for y and y'
+//
+// All stages are unrolled at compile time and every term with a zero weight is dropped from the generated arithmetic,
+// so tableaus can be transcribed in full from the literature without paying for their sparsity. The value type T is
+// double, or Batch<N> to advance N independent states at once.
+//
+// The ODE is evaluated at the intermediate stage nodes x + c * h, so functors that declare a static constexpr bool
+// kIgnoresX = true, because they read x dependent inputs from elsewhere, are rejected at compile time.
+namespace detail {
+
+template<typename ODE, typename = void>
+struct IgnoresX : std::false_type {};
+
+template<typename ODE>
+struct IgnoresX<ODE, std::void_t<decltype(ODE::kIgnoresX)>> : std::integral_constant<bool, ODE::kIgnoresX> {};
+
+// Compile-time views of the tableau coefficient rows, so the sums below can test each weight with if constexpr.
+template<typename Tableau, std::size_t I>
+struct ARow {
+    static constexpr double Weight(std::size_t j) { return Tableau::a[I][j]; }
+};
+
+template<typename Tableau, std::size_t I>
+struct APrimeRow {
+    static constexpr double Weight(std::size_t j) { return Tableau::aPrime[I][j]; }
+};
+
+template<typename Tableau>
+struct BRow {
+    static constexpr double Weight(std::size_t j) { return Tableau::b[j]; }
+};
+
+template<typename Tableau>
+struct BPrimeRow {
+    static constexpr double Weight(std::size_t j) { return Tableau::bPrime[j]; }
+};
+
+template<typename Tableau>
+struct BHatRow {
+    static constexpr double Weight(std::size_t j) { return Tableau::bHat[j]; }
+};
+
+template<typename Tableau>
+struct BHatPrimeRow {
+    static constexpr double Weight(std::size_t j) { return Tableau::bHatPrime[j]; }
+};
+
+template<typename Row, std::size_t N>
+constexpr bool HasWeights() {
+    for (std::size_t j = 0; j < N; ++j) {
+        if (Row::Weight(j) != 0.0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename Tableau>
+constexpr bool IsExplicit() {
+    for (std::size_t i = 0; i < Tableau::kStages; ++i) {
+        for (std::size_t j = i; j < Tableau::kStages; ++j) {
+            if (Tableau::a[i][j] != 0.0 || Tableau::aPrime[i][j] != 0.0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+constexpr bool NearlyEqual(const double a, const double b) {
+    double difference = a - b;
+    double magnitude = b < 0.0 ? -b : b;
+    return (difference < 0.0 ? -difference : difference) <= 1e-12 * (1.0 + magnitude);
+}
+
+// Checks the row sums of the stage weights, which catches most transcription errors in a tableau. The y' rows must sum
+// to the stage nodes. The y rows must sum to c^2 / 2, or for tableaus derived from a first-order Runge-Kutta method
+// with a = A^2 and aPrime = A, to the aPrime row applied to the nodes.
+template<typename Tableau>
+constexpr bool IsConsistent() {
+    for (std::size_t i = 0; i < Tableau::kStages; ++i) {
+        double aSum = 0.0;
+        double aPrimeSum = 0.0;
+        double aPrimeNodeSum = 0.0;
+        for (std::size_t j = 0; j < Tableau::kStages; ++j) {
+            aSum += Tableau::a[i][j];
+            aPrimeSum += Tableau::aPrime[i][j];
+            aPrimeNodeSum += Tableau::aPrime[i][j] * Tableau::c[j];
+        }
+        if (!NearlyEqual(aPrimeSum, Tableau::c[i])) {
+            return false;
+        }
+        if (!NearlyEqual(aSum, Tableau::c[i] * Tableau::c[i] / 2.0) && !NearlyEqual(aSum, aPrimeNodeSum)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Adds the terms Row::Weight(j) * k[j] for j in [J, N) to sum, left to right, skipping zero weights.
+template<typename Row, std::size_t J, std::size_t N, typename T>
+inline T Accumulate(const T& sum, const T (&k)[N]) {
+    if constexpr (J == N) {
+        return sum;
+    } else if constexpr (Row::Weight(J) == 0.0) {
+        return Accumulate<Row, J + 1, N>(sum, k);
+    } else {
+        return Accumulate<Row, J + 1, N>(sum + (Row::Weight(J) * k[J]), k);
+    }
+}
+
+// Returns the sum of Row::Weight(j) * k[j]. Only valid for rows where HasWeights() is true.
+template<typename Row, std::size_t J, std::size_t N, typename T>
+inline T WeightedSum(const T (&k)[N]) {
+    if constexpr (Row::Weight(J) == 0.0) {
+        return WeightedSum<Row, J + 1, N>(k);
+    } else {
+        return Accumulate<Row, J + 1, N>(Row::Weight(J) * k[J], k);
+    }
+}
+
+// Returns base + (scale * WeightedSum()), or base alone if the row is all zeros.
+template<typename Row, std::size_t N, typename T>
+inline T AddWeightedSum(const T& base, const double scale, const T (&k)[N]) {
+    if constexpr (HasWeights<Row, N>()) {
+        return base + (scale * WeightedSum<Row, 0, N>(k));
+    } else {
+        return base;
+    }
+}
+
+template<typename Tableau, std::size_t I, typename ODE, typename T>
+inline void EvaluateStages(const ODE& f, const double h, const double h2, const T& x, const T& y, const T& yPrime,
+    T (&k)[Tableau::kStages]) {
+    if constexpr (I < Tableau::kStages) {
+        constexpr double c = Tableau::c[I];
+        T xStage = x;
+        T yStage = y;
+        if constexpr (c != 0.0) {
+            xStage = x + (h * c);
+            yStage = y + (h * c * yPrime);
+        }
+        yStage = AddWeightedSum<ARow<Tableau, I>>(yStage, h2, k);
+        T yPrimeStage = AddWeightedSum<APrimeRow<Tableau, I>>(yPrime, h, k);
+
+        k[I] = f(xStage, yStage, yPrimeStage);
+
+        EvaluateStages<Tableau, I + 1>(f, h, h2, x, y, yPrime, k);
+    }
+}
+
+}    // namespace detail
+
+// Advances (x, y, y') by one step of size h, returning the solution in yOut and yPrimeOut and the embedded (lower
+// order) solution in yHatOut and yHatPrimeOut.
+template<typename Tableau, typename ODE, typename T>
+void RungeKuttaNystrom(const ODE& f, const double h, const NonDeduced<T> x, const NonDeduced<T> y,
+    const NonDeduced<T> yPrime, T& yOut, T& yPrimeOut, T& yHatOut, T& yHatPrimeOut) {
+    static_assert(detail::IsExplicit<Tableau>(), "RungeKuttaNystrom requires an explicit tableau.");
+    static_assert(detail::IsConsistent<Tableau>(), "Tableau stage weights do not sum to their nodes.");
+    static_assert(!detail::IgnoresX<ODE>::value, "RungeKuttaNystrom requires an ODE that is evaluated at x.");
+
+    double h2 = h * h;
+    T k[Tableau::kStages];
+    detail::EvaluateStages<Tableau, 0>(f, h, h2, x, y, yPrime, k);
+
+    T yBase = y + (h * yPrime);
+    yOut = detail::AddWeightedSum<detail::BRow<Tableau>>(yBase, h2, k);
+    yPrimeOut = detail::AddWeightedSum<detail::BPrimeRow<Tableau>>(yPrime, h, k);
+    yHatOut = detail::AddWeightedSum<detail::BHatRow<Tableau>>(yBase, h2, k);
+    yHatPrimeOut = detail::AddWeightedSum<detail::BHatPrimeRow<Tableau>>(yPrime, h, k);
+}
+
+// Advances count independent states, stored as arrays of x, y, and y', N lanes at a time. The ODE must be vectorizable
+// as described in Batch.hpp, and may provide ForLanes() for per-state parameters. Output arrays may alias the
+// corresponding input arrays.
+template<std::size_t N, typename Tableau, typename ODE>
+void RungeKuttaNystrom(const ODE& f, const double h, const std::size_t count, const double* x, const double* y,
+    const double* yPrime, double* yOut, double* yPrimeOut, double* yHatOut, double* yHatPrimeOut) {
+    for (std::size_t i = 0; i < count; i += N) {
+        std::size_t lanes = count - i < N ? count - i : N;
+        decltype(auto) batchF = detail::ForLanes<N>(f, i, lanes);
+        Batch<N> yNext, yPrimeNext, yHat, yHatPrime;
+        RungeKuttaNystrom<Tableau>(batchF, h, LoadBatch<N>(x + i, lanes), LoadBatch<N>(y + i, lanes),
+            LoadBatch<N>(yPrime + i, lanes), yNext, yPrimeNext, yHat, yHatPrime);
+        StoreBatch<N>(yNext, yOut + i, lanes);
+        StoreBatch<N>(yPrimeNext, yPrimeOut + i, lanes);
+        StoreBatch<N>(yHat, yHatOut + i, lanes);
+        StoreBatch<N>(yHatPrime, yHatPrimeOut + i, lanes);
+    }
+}
+
+}    // namespace egSC
+
+#endif    // SRC_UGEN_RUNGE_KUTTA_NYSTROM_HPP_
@@ -0,0 +1,243 @@
+#include "RungeKuttaNystrom.hpp"
+
+#include "BogackiShampineRKNG3.hpp"
+#include "DormandPrinceRKNG5.hpp"
+#include "SharpFineRKNG8.hpp"
+#include "VanDerPolTestData.hpp"
+#include "VectorizableTestFunctors.hpp"
+
+#include "doctest/doctest.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+
+// SharpFineRKNG8Tableau is covered by the closed form and van der Pol tests in SharpFineRKNG8_test.cpp.
+TEST_CASE_TEMPLATE("RungeKuttaNystrom simple first-order integration with closed form", Tableau,
+    egSC::BogackiShampineRKNG3Tableau, egSC::DormandPrinceRKNG5Tableau) {
+    struct FirstOrderFunctor {
+        double operator()(double x, double y, double yPrime) const {
+            return 2.0;
+        }
+    };
+
+    FirstOrderFunctor f;
+    double h = 0.25;
+    double x = 0.0;
+    double y = 0.0;
+    double yPrime = 0.0;
+    double yNext, yPrimeNext, yHat, yHatPrime;
+
+    for (std::size_t i = 0; i < 2500; ++i) {
+        egSC::RungeKuttaNystrom<Tableau>(f, h, x, y, yPrime, yNext, yPrimeNext, yHat, yHatPrime);
+
+        x += h;
+        y = yNext;
+        yPrime = yPrimeNext;
+
+        CHECK(y == doctest::Approx(x * x));
+        CHECK(yPrime == doctest::Approx(2.0 * x));
+    }
+}
+
+TEST_CASE_TEMPLATE("RungeKuttaNystrom with van der Pol second-order nonlinear ODE", Tableau,
+    egSC::BogackiShampineRKNG3Tableau, egSC::DormandPrinceRKNG5Tableau) {
+    constexpr double maxStep = 1.0 / 250.0;
+
+    struct VanDerPolFunctor {
+        double operator()(double x, double y, double yPrime) const {
+            return ((1.0 - (y * y)) * yPrime) - y;
+        }
+    };
+
+    VanDerPolFunctor f;
+
+    double x = kVanDerPolTestData[0];
+    double y = kVanDerPolTestData[1];
+    double yPrime = kVanDerPolTestData[2];
+    double h = kVanDerPolTestData[3] - x;
+    double yNext, yPrimeNext, yHat, yHatPrime;
+
+    for (std::size_t i = 1; i < kVanDerPolTestDataCount - 1; ++i) {
+        REQUIRE_GT(h, 0.0);
+
+        while (h > maxStep) {
+            egSC::RungeKuttaNystrom<Tableau>(f, maxStep, x, y, yPrime, yNext, yPrimeNext, yHat, yHatPrime);
+            h = h - maxStep;
+            x = x + maxStep;
+            y = yNext;
+            yPrime = yPrimeNext;
+        }
+
+        egSC::RungeKuttaNystrom<Tableau>(f, h, x, y, yPrime, yNext, yPrimeNext, yHat, yHatPrime);
+
+        // Check both y and y', and that the embedded solution agrees to the same tolerance.
+        CHECK(yNext == doctest::Approx(kVanDerPolTestData[(i * 3) + 1]).epsilon(0.01));
+        CHECK(yPrimeNext == doctest::Approx(kVanDerPolTestData[(i * 3) + 2]).epsilon(0.01));
+        CHECK(yHat == doctest::Approx(kVanDerPolTestData[(i * 3) + 1]).epsilon(0.01));
+        CHECK(yHatPrime == doctest::Approx(kVanDerPolTestData[(i * 3) + 2]).epsilon(0.01));
+
+        x = kVanDerPolTestData[i * 3];
+        h = kVanDerPolTestData[(i + 1) * 3] - x;
+
+        y = kVanDerPolTestData[(i * 3) + 1];
+        yPrime = kVanDerPolTestData[(i * 3) + 2];
+    }
+}
+
+namespace {
+
+// Damped oscillator forced by a function of x, with the closed form solution y = sin(3x) + x^2 for y(0) = 0, y'(0) = 3.
+// The forcing term samples x at every stage node, so wrong nodes or stage weights show up as a lower convergence order.
+struct ForcedOscillatorFunctor {
+    double operator()(double x, double y, double yPrime) const {
+        return -yPrime - y - (8.0 * std::sin(3.0 * x)) + (3.0 * std::cos(3.0 * x)) + (x * x) + (2.0 * x) + 2.0;
+    }
+};
+
+// Integrates the forced oscillator from 0 to 1 in count steps, returning the largest error in y or y' at x = 1 for
+// the solution (embedded false) or the embedded solution (embedded true).
+template<typename Tableau>
+double ForcedOscillatorError(std::size_t count, bool embedded) {
+    ForcedOscillatorFunctor f;
+    double h = 1.0 / static_cast<double>(count);
+    double y = 0.0;
+    double yPrime = 3.0;
+    for (std::size_t i = 0; i < count; ++i) {
+        double yNext, yPrimeNext, yHat, yHatPrime;
+        egSC::RungeKuttaNystrom<Tableau>(f, h, h * static_cast<double>(i), y, yPrime, yNext, yPrimeNext, yHat,
+            yHatPrime);
+        y = embedded ? yHat : yNext;
+        yPrime = embedded ? yHatPrime : yPrimeNext;
+    }
+    double yError = std::abs(y - (std::sin(3.0) + 1.0));
+    double yPrimeError = std::abs(yPrime - ((3.0 * std::cos(3.0)) + 2.0));
+    return yError > yPrimeError ? yError : yPrimeError;
+}
+
+// Returns the convergence order observed when halving the step size from 1/count.
+template<typename Tableau>
+double ObservedOrder(std::size_t count, bool embedded) {
+    return std::log2(ForcedOscillatorError<Tableau>(count, embedded) /
+        ForcedOscillatorError<Tableau>(count * 2, embedded));
+}
+
+}    // namespace
+
+TEST_CASE("RungeKuttaNystrom convergence order with x-dependent forcing") {
+    // Step counts are chosen so the errors stay well above rounding.
+    CHECK(ObservedOrder<egSC::BogackiShampineRKNG3Tableau>(16, false) > 2.8);
+    CHECK(ObservedOrder<egSC::BogackiShampineRKNG3Tableau>(16, true) > 1.8);
+    CHECK(ObservedOrder<egSC::DormandPrinceRKNG5Tableau>(8, false) > 4.8);
+    CHECK(ObservedOrder<egSC::DormandPrinceRKNG5Tableau>(8, true) > 3.8);
+    CHECK(ObservedOrder<egSC::SharpFineRKNG8Tableau>(8, false) > 5.6);
+    CHECK(ObservedOrder<egSC::SharpFineRKNG8Tableau>(8, true) > 4.6);
+}
+
+namespace {
+
+struct VectorizableVanDerPolFunctor {
+    template<typename T>
+    T operator()(const T& x, const T& y, const T& yPrime) const {
+        return ((1.0 - (y * y)) * yPrime) - y;
+    }
+};
+
+// Advances kCount states with different initial conditions both one at a time and N at a time, and checks that every
+// lane of the batched results agrees with the scalar ones. The count is not a multiple of the batch width, so the
+// partial last batch is covered too.
+template<std::size_t N, typename Tableau>
+void CheckBatchedMatchesScalar() {
+    constexpr std::size_t kCount = 13;
+    constexpr double h = 1.0 / 250.0;
+
+    VectorizableVanDerPolFunctor f;
+    double x[kCount], y[kCount], yPrime[kCount], yHat[kCount], yHatPrime[kCount];
+    double xScalar[kCount], yScalar[kCount], yPrimeScalar[kCount], yHatScalar[kCount], yHatPrimeScalar[kCount];
+    for (std::size_t i = 0; i < kCount; ++i) {
+        x[i] = 0.0;
+        y[i] = 2.0 - (0.25 * i);
+        yPrime[i] = -1.0 + (0.125 * i);
+        xScalar[i] = x[i];
+        yScalar[i] = y[i];
+        yPrimeScalar[i] = yPrime[i];
+    }
+
+    for (std::size_t step = 0; step < 500; ++step) {
+        egSC::RungeKuttaNystrom<N, Tableau>(f, h, kCount, x, y, yPrime, y, yPrime, yHat, yHatPrime);
+
+        for (std::size_t i = 0; i < kCount; ++i) {
+            egSC::RungeKuttaNystrom<Tableau>(f, h, xScalar[i], yScalar[i], yPrimeScalar[i], yScalar[i], yPrimeScalar[i],
+                yHatScalar[i], yHatPrimeScalar[i]);
+            xScalar[i] += h;
+            x[i] += h;
+        }
+
+        CheckLanesMatch(y, yScalar, kCount);
+        CheckLanesMatch(yPrime, yPrimeScalar, kCount);
+        CheckLanesMatch(yHat, yHatScalar, kCount);
+        CheckLanesMatch(yHatPrime, yHatPrimeScalar, kCount);
+    }
+}
+
+}    // namespace
+
+TEST_CASE_TEMPLATE("RungeKuttaNystrom batched matches scalar", Tableau, egSC::BogackiShampineRKNG3Tableau,
+    egSC::DormandPrinceRKNG5Tableau, egSC::SharpFineRKNG8Tableau) {
+    CheckBatchedMatchesScalar<1, Tableau>();
+    CheckBatchedMatchesScalar<4, Tableau>();
+    CheckBatchedMatchesScalar<8, Tableau>();
+}
+
+TEST_CASE_TEMPLATE("RungeKuttaNystrom batched sweeps damping across lanes", Tableau,
+    egSC::BogackiShampineRKNG3Tableau, egSC::DormandPrinceRKNG5Tableau, egSC::SharpFineRKNG8Tableau) {
+    constexpr std::size_t kCount = 11;
+    constexpr double h = 1.0 / 16.0;
+
+    double damping[kCount], x[kCount], y[kCount], yPrime[kCount], yHat[kCount], yHatPrime[kCount];
+    for (std::size_t i = 0; i < kCount; ++i) {
+        damping[i] = 0.1 * i;
+        x[i] = 0.0;
+        y[i] = 1.0;
+        yPrime[i] = 0.0;
+    }
+
+    DampingSweepFunctor f{ damping };
+    for (std::size_t step = 0; step < 64; ++step) {
+        egSC::RungeKuttaNystrom<4, Tableau>(f, h, kCount, x, y, yPrime, y, yPrime, yHat, yHatPrime);
+        for (std::size_t i = 0; i < kCount; ++i) {
+            x[i] += h;
+        }
+    }
+
+    // Each lane must match the closed form of its own damped oscillator, y = e^(-zt) (cos(wt) + (z / w) sin(wt)) with
+    // z = damping / 2 and w = sqrt(1 - z^2).
+    for (std::size_t i = 0; i < kCount; ++i) {
+        double z = damping[i] / 2.0;
+        double w = std::sqrt(1.0 - (z * z));
+        double t = x[i];
+        double expected = std::exp(-z * t) * (std::cos(w * t) + ((z / w) * std::sin(w * t)));
+        CHECK(y[i] == doctest::Approx(expected).epsilon(1e-4));
+    }
+}
+
+TEST_CASE("RungeKuttaNystrom wrappers accept mixed argument types") {
+    DampedFunctor<double> f{ 0.1 };
+    double y, yPrime, yHat, yHatPrime;
+    double yDouble, yPrimeDouble;
+
+    egSC::BogackiShampineRKNG3(f, 0.25, 0, 1, 0, y, yPrime, yHat, yHatPrime);
+    egSC::BogackiShampineRKNG3(f, 0.25, 0.0, 1.0, 0.0, yDouble, yPrimeDouble, yHat, yHatPrime);
+    CHECK(y == yDouble);
+    CHECK(yPrime == yPrimeDouble);
+
+    egSC::DormandPrinceRKNG5(f, 0.25, 0, 1.0f, 0, y, yPrime, yHat, yHatPrime);
+    egSC::DormandPrinceRKNG5(f, 0.25, 0.0, 1.0, 0.0, yDouble, yPrimeDouble, yHat, yHatPrime);
+    CHECK(y == yDouble);
+    CHECK(yPrime == yPrimeDouble);
+
+    egSC::SharpFineRKNG8(f, 0.25, 0, 1, 0, y, yPrime, yHat, yHatPrime);
+    egSC::RungeKuttaNystrom<egSC::SharpFineRKNG8Tableau>(f, 0.25, 0, 1, 0, yDouble, yPrimeDouble, yHat, yHatPrime);
+    CHECK(y == yDouble);
+    CHECK(yPrime == yPrimeDouble);
+}
@@ -0,0 +1,38 @@
+#ifndef SRC_UGEN_VECTORIZABLE_TEST_FUNCTORS_HPP_
+#define SRC_UGEN_VECTORIZABLE_TEST_FUNCTORS_HPP_
+
+#include "Batch.hpp"
+
+#include "doctest/doctest.h"
+
+#include <cstddef>
+
+// Damped linear oscillator y'' = -d * y' - y, with the damping d either a double or one value per lane.
+template<typename Damping>
+struct DampedFunctor {
+    template<typename T>
+    T operator()(const T& x, const T& y, const T& yPrime) const {
+        return -(m_Damping * yPrime) - y;
+    }
+
+    Damping m_Damping;
+};
+
+// Gives each state its own damping, read from an array with one value per state.
+struct DampingSweepFunctor {
+    template<std::size_t N>
+    DampedFunctor<egSC::Batch<N>> ForLanes(std::size_t first, std::size_t lanes) const {
+        return DampedFunctor<egSC::Batch<N>>{ egSC::LoadBatch<N>(m_Damping + first, lanes) };
+    }
+
+    const double* m_Damping;
+};
+
+// Checks that every state advanced by a batched integrator agrees with the same state advanced one at a time.
+inline void CheckLanesMatch(const double* batched, const double* scalar, const std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        CHECK(batched[i] == doctest::Approx(scalar[i]).epsilon(1e-12));
+    }
+}
+
+#endif    // SRC_UGEN_VECTORIZABLE_TEST_FUNCTORS_HPP_